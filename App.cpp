@@ -2,11 +2,83 @@
 #include "MainFrame.h"
 #include <wx/wx.h>
 
+#define IPC_SERVICE "AutoMute"
+#define IPC_TOPIC "profile"
+
 wxIMPLEMENT_APP(App);
 
 bool App::OnInit() {
-	MainFrame* mainFrame = new MainFrame("AutoMute");
+	// AutoMute.exe --profile <name> starts with the given profile active, or switches the running copy to it
+	std::string startup_profile;
+	for (int i = 1; i + 1 < argc; i++) {
+		if (argv[i] == "--profile") {
+			startup_profile = argv[i + 1].ToStdString();
+		}
+	}
+
+	// a second copy would mute and rewrite the schedule files independently of the first one
+	instance_checker = new wxSingleInstanceChecker();
+	if (instance_checker->IsAnotherRunning()) {
+		if (startup_profile.empty()) {
+			wxMessageBox("AutoMute is already running.", "AutoMute");
+		}
+		else {
+			wxClient client;
+			wxConnectionBase* connection = client.MakeConnection("localhost", IPC_SERVICE, IPC_TOPIC);
+			if (connection) {
+				connection->Execute(startup_profile);
+				connection->Disconnect();
+				delete connection;
+			}
+			else {
+				wxMessageBox("Could not reach the running AutoMute.", "AutoMute");
+			}
+		}
+
+		delete instance_checker;
+		instance_checker = nullptr;
+		return false;
+	}
+
+	MainFrame* mainFrame = new MainFrame("AutoMute", startup_profile);
 	mainFrame->Center();
 	mainFrame->Show();
+
+	profile_server = new ProfileServer(mainFrame);
+	profile_server->Create(IPC_SERVICE);
+	return true;
+}
+
+int App::OnExit() {
+	delete profile_server;
+	delete instance_checker;
+	return wxApp::OnExit();
+}
+
+
+ProfileServer::ProfileServer(MainFrame* main_frame) : wxServer(), main_frame(main_frame) {
+}
+
+wxConnectionBase* ProfileServer::OnAcceptConnection(const wxString& topic) {
+	if (topic == IPC_TOPIC) {
+		return new ProfileConnection(main_frame);
+	}
+
+	return nullptr;
+}
+
+
+ProfileConnection::ProfileConnection(MainFrame* main_frame) : wxConnection(), main_frame(main_frame) {
+}
+
+bool ProfileConnection::OnExecute(const wxString& topic, const void* data, size_t size, wxIPCFormat format) {
+	std::string name = GetTextFromData(data, size, format).ToStdString();
+
+	// switch_profile waits for the worker thread, so don't block the other process while it does
+	MainFrame* frame = main_frame;
+	frame->CallAfter([frame, name]() {
+		frame->switch_profile(name);
+	});
+
 	return true;
 }
@@ -1,9 +1,38 @@
 #pragma once
 #include <wx/wx.h>
+#include <wx/snglinst.h>
+#include <wx/ipc.h>
+
+class MainFrame;
+class ProfileServer;
 
 class App: public wxApp
 {
 public:
 	bool OnInit();
+	int OnExit();
+
+private:
+	wxSingleInstanceChecker* instance_checker = nullptr;
+	ProfileServer* profile_server = nullptr;
+};
+
+// Lets AutoMute started again with --profile <name> switch the profile of the running copy
+class ProfileServer : public wxServer {
+public:
+	ProfileServer(MainFrame* main_frame);
+	wxConnectionBase* OnAcceptConnection(const wxString& topic);
+
+private:
+	MainFrame* main_frame;
+};
+
+class ProfileConnection : public wxConnection {
+public:
+	ProfileConnection(MainFrame* main_frame);
+	bool OnExecute(const wxString& topic, const void* data, size_t size, wxIPCFormat format);
+
+private:
+	MainFrame* main_frame;
 };
 
@@ -22,11 +22,18 @@
 #include <wx/statline.h>
 
 #define MENU_EXIT_OPTION_ID 100
+#define MENU_PROFILE_OPTION_ID 200 // profile i has id MENU_PROFILE_OPTION_ID + i
 
-void save_mute_frames(std::vector<MuteFrame> frames, bool append);
-std::pair<bool, int> is_any_frame_active(std::vector<MuteFrame> frames);
+const char* profile_names[] = { "default", "office", "home", "holidays" };
+const int profile_count = sizeof(profile_names) / sizeof(profile_names[0]);
+
+const std::time_t SECONDS_IN_WEEK = 7 * 24 * 60 * 60;
+const char* days_of_week[] = { "Sun", "Mon", "Tues", "Wed", "Thurs", "Fri", "Sat" }; // indexed by tm_wday
+
+void save_mute_frames(std::vector<MuteFrame> frames, bool append, const std::string& file_name);
+std::pair<bool, int> is_any_frame_active(const ScheduleProfile& profile);
 void set_mute(BOOL mute);
-std::vector<MuteFrame> read_frames();
+std::vector<MuteFrame> read_frames(const std::string& file_name);
 
 std::vector<std::string> get_next_week_days_with_dates() {
 	const char* days[] = { "Mon", "Tues", "Wed", "Thurs", "Fri", "Sat", "Sun" };
@@ -63,6 +70,28 @@ std::pair<int, int> get_current_hour_and_minutes() {
 	return std::make_pair(now->tm_hour, now->tm_min);
 }
 
+std::time_t to_epoch(int year, int month, int day, int hour, int minute) {
+	std::tm time_tm = {};
+	time_tm.tm_isdst = -1; // daylight saving time information
+	time_tm.tm_year = year - 1900;
+	time_tm.tm_mon = month - 1;
+	time_tm.tm_mday = day;
+	time_tm.tm_hour = hour;
+	time_tm.tm_min = minute;
+	time_tm.tm_sec = 0;
+
+	return std::mktime(&time_tm);
+}
+
+// for weekly frames: add a week worth of time enough times so the frame ends after now
+void roll_to_current_week(std::time_t& start_time, std::time_t& end_time, std::time_t now) {
+	if (now > end_time) {
+		int weeks_to_add = (now - end_time) / SECONDS_IN_WEEK + 1;
+		start_time += weeks_to_add * SECONDS_IN_WEEK;
+		end_time += weeks_to_add * SECONDS_IN_WEEK;
+	}
+}
+
 // changes (1.2.3) to [1, 2, 3]
 std::vector<int> parse_date(std::string date_string) {
 	std::vector<int> date_parts;
@@ -82,7 +111,26 @@ std::vector<int> parse_date(std::string date_string) {
 }
 
 
-MainFrame::MainFrame(const wxString& title) : wxFrame(nullptr, wxID_ANY, title) {
+MainFrame::MainFrame(const wxString& title, const std::string& startup_profile) : wxFrame(nullptr, wxID_ANY, title) {
+
+	// load every profile once, later switching only swaps the active pointer
+	for (int i = 0; i < profile_count; i++) {
+		profiles.push_back(std::make_unique<ScheduleProfile>(profile_names[i]));
+	}
+	active_profile = profiles[0].get();
+
+	// a valid profile given at startup wins over the saved one, it has to be set before the thread starts
+	std::string profile_name;
+	std::ifstream active_profile_file("active_profile.txt");
+	active_profile_file >> profile_name;
+
+	bool unknown_startup_profile = !startup_profile.empty() && find_profile(startup_profile) == nullptr;
+	if (!startup_profile.empty() && !unknown_startup_profile) {
+		profile_name = startup_profile;
+	}
+	if (ScheduleProfile* profile = find_profile(profile_name)) {
+		active_profile = profile;
+	}
 
 	task_bar_icon = new TaskBarIcon(this);
 	Bind(wxEVT_CLOSE_WINDOW, &MainFrame::OnClose, this);
@@ -127,6 +175,12 @@ MainFrame::MainFrame(const wxString& title) : wxFrame(nullptr, wxID_ANY, title)
 	delete_button = new wxButton(panel, wxID_ANY, "Delete", wxDefaultPosition, wxDefaultSize);
 	delete_button->Bind(wxEVT_BUTTON, &MainFrame::OnDeleteButtonClicked, this);
 	delete_button->SetBackgroundColour(wxColour(0xD9, 0x9F, 0xA0));
+	wxStaticText* upcoming_count_label = new wxStaticText(panel, wxID_ANY, "Upcoming transitions to show:");
+	upcoming_count = new wxSpinCtrl(panel, wxID_ANY, "Upcoming transitions", wxDefaultPosition, wxDefaultSize);
+	upcoming_count->SetRange(1, 50);
+	upcoming_count->SetValue(upcoming_transition_count);
+	upcoming_count->Bind(wxEVT_SPINCTRL, &MainFrame::OnUpcomingCountChanged, this);
+	upcoming_list = new wxListBox(panel, wxID_ANY, wxDefaultPosition, wxSize(700, -1));
 	wxStaticLine* horizontal_line2 = new wxStaticLine(panel, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLI_VERTICAL);
 	autostart_button = new wxButton(panel, wxID_ANY, "Start the application automatically at system startup", wxDefaultPosition, wxDefaultSize);
 	autostart_button->Bind(wxEVT_BUTTON, &MainFrame::autostart_button_clicked, this);
@@ -163,10 +217,19 @@ MainFrame::MainFrame(const wxString& title) : wxFrame(nullptr, wxID_ANY, title)
 	mainSizer->AddSpacer(5);
 	mainSizer->Add(delete_button, wxSizerFlags().CenterHorizontal());
 	mainSizer->AddSpacer(20);
+	mainSizer->Add(upcoming_count_label, wxSizerFlags().Center());
+	mainSizer->AddSpacer(10);
+	mainSizer->Add(upcoming_count, wxSizerFlags().Center());
+	mainSizer->AddSpacer(10);
+	mainSizer->Add(upcoming_list, wxSizerFlags().CenterHorizontal());
+	mainSizer->AddSpacer(20);
 	mainSizer->Add(horizontal_line2, 0, wxEXPAND | wxALL, 10);
 	mainSizer->Add(autostart_button, wxSizerFlags().CenterHorizontal());
 	mainSizer->AddSpacer(30);
 	CreateStatusBar();
+	if (unknown_startup_profile) {
+		wxLogStatus(this, "Unknown profile: %s", startup_profile);
+	}
 
 	panel->SetSizer(mainSizer);
 	mainSizer->SetSizeHints(this);
@@ -188,18 +251,105 @@ void MainFrame::OnDeleteButtonClicked(wxCommandEvent& event) {
 
 
 void MainFrame::delete_frame(int line_no) {
-	std::vector<MuteFrame> frames = read_frames();
+	ScheduleProfile* profile = active_profile.load();
 
-	if (line_no >= 0 && line_no < frames.size()) {
-		frames.erase(frames.begin() + line_no);
-	}
+	{
+		std::lock_guard<std::mutex> profile_lock(profile_mtx);
+		if (line_no >= 0 && line_no < profile->frames.size()) {
+			profile->frames.erase(profile->frames.begin() + line_no);
+		}
 
-	save_mute_frames(frames, false);
+		profile->rebuild_index();
+		profile->save();
+	}
 
 	wxLogStatus("");
 }
 
 
+void MainFrame::switch_profile(const std::string& name) {
+	ScheduleProfile* profile = find_profile(name);
+	if (profile == nullptr) {
+		wxLogStatus("Unknown profile: %s", name);
+		return;
+	}
+
+	active_profile = profile;
+
+	std::ofstream active_profile_file("active_profile.txt");
+	active_profile_file << name << "\n";
+
+	// lines of the old profile must not be used for deleting from the new one
+	frame_list->Clear();
+	upcoming_list->Clear();
+
+	manage_frames_in_thread(); // wake the thread so it uses the new profile
+	wxLogStatus("Active profile: %s", name);
+}
+
+
+ScheduleProfile* MainFrame::find_profile(const std::string& name) {
+	for (const std::unique_ptr<ScheduleProfile>& profile : profiles) {
+		if (profile->name == name) {
+			return profile.get();
+		}
+	}
+
+	return nullptr;
+}
+
+
+std::vector<std::string> MainFrame::get_profile_names() {
+	std::vector<std::string> names;
+	for (const std::unique_ptr<ScheduleProfile>& profile : profiles) {
+		names.push_back(profile->name);
+	}
+
+	return names;
+}
+
+
+std::string MainFrame::get_active_profile_name() {
+	return active_profile.load()->name;
+}
+
+
+std::vector<MuteTransition> MainFrame::get_next_transitions(int count) {
+	std::vector<MuteTransition> result;
+
+	std::lock_guard<std::mutex> profile_lock(profile_mtx);
+	UpcomingTransitions transitions(*active_profile.load(), std::time(nullptr));
+	MuteTransition transition;
+	while (result.size() < static_cast<size_t>(count) && transitions.next(transition)) {
+		result.push_back(transition);
+	}
+
+	return result;
+}
+
+
+void MainFrame::OnUpcomingCountChanged(wxSpinEvent& event) {
+	upcoming_transition_count = upcoming_count->GetValue();
+	show_upcoming_transitions(get_next_transitions(upcoming_transition_count));
+}
+
+
+// has to be called on the GUI thread
+void MainFrame::show_upcoming_transitions(const std::vector<MuteTransition>& transitions) {
+	upcoming_list->Clear();
+	for (const MuteTransition& transition : transitions) {
+		std::tm* time_tm = std::localtime(&transition.time);
+
+		std::ostringstream oss;
+		oss << (transition.mute ? "Mute" : "Unmute") << ": "
+			<< std::put_time(time_tm, "%Y-%m-%d") << " ("
+			<< days_of_week[time_tm->tm_wday] << ") "
+			<< time_tm->tm_hour << ":" << (time_tm->tm_min < 10 ? "0" : "") << time_tm->tm_min;
+		upcoming_list->Append(oss.str());
+	}
+}
+
+
 void MainFrame::autostart_button_clicked(wxCommandEvent& event) {
 	system("add_to_startup.bat");
 }
@@ -244,7 +394,14 @@ void MainFrame::OnAddButtonClicked(wxCommandEvent& event) {
 		repeat_every_week->IsChecked()
 	);
 
-	save_mute_frames({ new_frame }, true);
+	ScheduleProfile* profile = active_profile.load();
+	{
+		std::lock_guard<std::mutex> profile_lock(profile_mtx);
+		profile->frames.push_back(new_frame);
+		profile->rebuild_index();
+		save_mute_frames({ new_frame }, true, profile->file_name);
+	}
+
 	manage_frames_in_thread();
 }
 
@@ -284,38 +441,51 @@ void MainFrame::manage_frames_in_thread() {
 
 // return seconds remaining to the next event
 int MainFrame::manage_frames() {
-	std::vector<MuteFrame> frames = read_frames();
+	ScheduleProfile* profile = active_profile.load();
+	std::vector<std::string> frame_descriptions;
+	std::pair<bool, int> result;
+
+	{
+		std::lock_guard<std::mutex> profile_lock(profile_mtx);
+
+		// filter out outdated frames
+		std::time_t current_time = std::time(nullptr);
+		std::vector<MuteFrame> updated_frames;
+		for (size_t i = 0; i < profile->frames.size(); i++) {
+			// weekly repeated frames are never outdated
+			if (profile->epochs[i].second > current_time || profile->frames[i].repeat_every_week) {
+				updated_frames.push_back(profile->frames[i]);
+			}
+		}
 
-	// filter out outdated frames
-	std::time_t current_time = std::time(nullptr);
-	std::vector<MuteFrame> updated_frames;
-	for (MuteFrame frame : frames) {
-		std::tm end_time = { 0 };
-		end_time.tm_isdst = -1; // daylight saving time information
-		end_time.tm_year = frame.end_year - 1900;
-		end_time.tm_mon = frame.end_month - 1;
-		end_time.tm_mday = frame.end_day;
-		end_time.tm_hour = frame.end_hour;
-		end_time.tm_min = frame.end_minute;
-		std::time_t end_epoch = std::mktime(&end_time);
-
-		if (end_epoch > current_time || frame.repeat_every_week) { // weekly repeated frames are never outdated
-			updated_frames.push_back(frame);
+		// update the file with remaining frames
+		if (updated_frames.size() != profile->frames.size()) {
+			profile->frames = updated_frames;
+			profile->rebuild_index();
+			profile->save();
 		}
-	}
 
-	// update the file with remaining frames
-	save_mute_frames(updated_frames, false);
+		for (size_t i = 0; i < profile->frames.size(); i++) {
+			frame_descriptions.push_back(profile->frames[i].to_string(profile->epochs[i].first, profile->epochs[i].second));
+		}
 
-	// update the frame_list
-	frame_list->Clear();
-	for (MuteFrame frame : updated_frames) {
-		frame_list->Append(frame.to_string());
+		// check if any frame is active
+		result = is_any_frame_active(*profile);
 	}
 
+	// wx controls are not thread safe, so the lists are filled on the GUI thread
+	std::vector<MuteTransition> transitions = get_next_transitions(upcoming_transition_count);
+	CallAfter([this, profile, frame_descriptions, transitions]() {
+		if (active_profile.load() == profile) { // the profile may have been switched in the meantime
+			frame_list->Clear();
+			for (const std::string& description : frame_descriptions) {
+				frame_list->Append(description);
+			}
+
+			show_upcoming_transitions(transitions);
+		}
+	});
 
-	// check if any frame is active
-	std::pair<bool, int> result = is_any_frame_active(updated_frames);
 	if (result.first) {
 		set_mute(true);
 	}
@@ -328,41 +498,21 @@ int MainFrame::manage_frames() {
 
 
 // <is any frame active now, seconds to wait until next event from any frame (either start or end of a frame) (-1 if no frames)>
-std::pair<bool, int> is_any_frame_active(std::vector<MuteFrame> frames) {
+std::pair<bool, int> is_any_frame_active(const ScheduleProfile& profile) {
 	std::time_t now = std::time(nullptr);
 	bool is_active = false;
 	int min_seconds_to_event = INT_MAX;
 
-	if (frames.empty()) {
+	if (profile.frames.empty()) {
 		return { false, -1 };
 	}
 
-	for (MuteFrame frame : frames) {
-		std::tm start_tm = {};
-		start_tm.tm_isdst = -1; // daylight saving time information
-		start_tm.tm_year = frame.start_year - 1900;
-		start_tm.tm_mon = frame.start_month - 1;
-		start_tm.tm_mday = frame.start_day;
-		start_tm.tm_hour = frame.start_hour;
-		start_tm.tm_min = frame.start_minute;
-		start_tm.tm_sec = 0;
-		std::time_t start_time = std::mktime(&start_tm);
-
-		std::tm end_tm = {};
-		end_tm.tm_isdst = -1; // daylight saving time information
-		end_tm.tm_year = frame.end_year - 1900;
-		end_tm.tm_mon = frame.end_month - 1;
-		end_tm.tm_mday = frame.end_day;
-		end_tm.tm_hour = frame.end_hour;
-		end_tm.tm_min = frame.end_minute;
-		end_tm.tm_sec = 0;
-		std::time_t end_time = std::mktime(&end_tm);
-
-		if (frame.repeat_every_week && now > end_time) {
-			// add a week worth of time enough times so it is current week
-			int weeks_to_add = (now - end_time) / (7 * 24 * 60 * 60) + 1;
-			start_time += weeks_to_add * (7 * 24 * 60 * 60);
-			end_time += weeks_to_add * (7 * 24 * 60 * 60);
+	for (size_t i = 0; i < profile.frames.size(); i++) {
+		std::time_t start_time = profile.epochs[i].first;
+		std::time_t end_time = profile.epochs[i].second;
+
+		if (profile.frames[i].repeat_every_week) {
+			roll_to_current_week(start_time, end_time, now);
 		}
 
 		// Is this frame active
@@ -405,83 +555,45 @@ void set_mute(BOOL mute) {
 }
 
 
-std::string MuteFrame::to_string() {
+// start_time and end_time are the frame's epochs from ScheduleProfile, so no mktime is needed here
+std::string MuteFrame::to_string(std::time_t start_time, std::time_t end_time) {
 	std::ostringstream oss;
 
-	const char* days_of_week[] = { "Sun", "Mon", "Tues", "Wed", "Thurs", "Fri", "Sat" };
-
-	std::tm start_tm = {};
-	start_tm.tm_isdst = -1;
-	start_tm.tm_year = start_year - 1900;
-	start_tm.tm_mon = start_month - 1;
-	start_tm.tm_mday = start_day;
-	std::mktime(&start_tm);
-
-	std::tm end_tm = {};
-	end_tm.tm_isdst = -1;
-	end_tm.tm_year = end_year - 1900;
-	end_tm.tm_mon = end_month - 1;
-	end_tm.tm_mday = end_day;
-	std::mktime(&end_tm);
+	int start_weekday = std::localtime(&start_time)->tm_wday;
+	int end_weekday = std::localtime(&end_time)->tm_wday;
 
 	oss << "Start: " << start_year << "-"
 		<< (start_month < 10 ? "0" : "") << start_month << "-"
 		<< (start_day < 10 ? "0" : "") << start_day << " ("
-		<< days_of_week[start_tm.tm_wday] << ") "
+		<< days_of_week[start_weekday] << ") "
 		<< start_hour << ":" << (start_minute < 10 ? "0" : "") << start_minute
 		<< "   -   "
 		<< "End: " << end_year << "-"
 		<< (end_month < 10 ? "0" : "") << end_month << "-"
 		<< (end_day < 10 ? "0" : "") << end_day << " ("
-		<< days_of_week[end_tm.tm_wday] << ") "
+		<< days_of_week[end_weekday] << ") "
 		<< end_hour << ":" << (end_minute < 10 ? "0" : "") << end_minute
 		<< "   -   "
 		<< "Repeat every week: " << (repeat_every_week ? "Yes" : "No") << "   -   "
-		<< "Active now: " << (does_overlap_with_current_time() ? "Yes" : "No");
+		<< "Active now: " << (does_overlap_with_current_time(start_time, end_time) ? "Yes" : "No");
 
 	return oss.str();
 }
 
 
-bool MuteFrame::does_overlap_with_current_time() {
-	std::time_t now = std::time(nullptr);
-	std::tm* current_time_tm = std::localtime(&now);
-
-	std::tm start_tm = {};
-	start_tm.tm_isdst = -1;
-	start_tm.tm_year = start_year - 1900;
-	start_tm.tm_mon = start_month - 1;
-	start_tm.tm_mday = start_day;
-	start_tm.tm_hour = start_hour;
-	start_tm.tm_min = start_minute;
-	start_tm.tm_sec = 0;
-
-	std::tm end_tm = {};
-	end_tm.tm_isdst = -1;
-	end_tm.tm_year = end_year - 1900;
-	end_tm.tm_mon = end_month - 1;
-	end_tm.tm_mday = end_day;
-	end_tm.tm_hour = end_hour;
-	end_tm.tm_min = end_minute;
-	end_tm.tm_sec = 0;
-
-	std::time_t start_time = std::mktime(&start_tm);
-	std::time_t end_time = std::mktime(&end_tm);
-	std::time_t current_time = std::mktime(current_time_tm);
-
-	if (repeat_every_week && current_time > end_time) {
-		// add a week worth of time enough times so it is current week
-		int weeks_to_add = (current_time - end_time) / (7 * 24 * 60 * 60) + 1;
-		start_time += weeks_to_add * (7 * 24 * 60 * 60);
-		end_time += weeks_to_add * (7 * 24 * 60 * 60);
+bool MuteFrame::does_overlap_with_current_time(std::time_t start_time, std::time_t end_time) {
+	std::time_t current_time = std::time(nullptr);
+
+	if (repeat_every_week) {
+		roll_to_current_week(start_time, end_time, current_time);
 	}
 
 	return (current_time >= start_time && current_time < end_time);
 }
 
-std::vector<MuteFrame> read_frames() {
+std::vector<MuteFrame> read_frames(const std::string& file_name) {
 	std::vector<MuteFrame> frames;
-	std::ifstream inFile("mute_frames.txt");
+	std::ifstream inFile(file_name);
 
 	if (inFile.is_open()) {
 		MuteFrame frame;
@@ -501,15 +613,15 @@ std::vector<MuteFrame> read_frames() {
 	return frames;
 }
 
-void save_mute_frames(std::vector<MuteFrame> frames, bool append) {
+void save_mute_frames(std::vector<MuteFrame> frames, bool append, const std::string& file_name) {
 
 	// write new frame to the file
 	std::ofstream outFile;
 	if (append) {
-		outFile.open("mute_frames.txt", std::ios::app);
+		outFile.open(file_name, std::ios::app);
 	}
 	else {
-		outFile.open("mute_frames.txt");
+		outFile.open(file_name);
 	}
 
 	if (outFile.is_open()) {
@@ -546,6 +658,103 @@ void MainFrame::OnMenuEvent(wxCommandEvent& event) {
 		Close();
 		Destroy();
 	}
+	else if (event.GetId() >= MENU_PROFILE_OPTION_ID && event.GetId() < MENU_PROFILE_OPTION_ID + profile_count) {
+		switch_profile(profile_names[event.GetId() - MENU_PROFILE_OPTION_ID]);
+	}
+}
+
+
+// "default" profile keeps the original file name
+ScheduleProfile::ScheduleProfile(const std::string& name)
+	: name(name), file_name(name == "default" ? "mute_frames.txt" : "mute_frames_" + name + ".txt") {
+	// a profile without a file yet is just empty
+	if (std::ifstream(file_name).is_open()) {
+		frames = read_frames(file_name);
+	}
+	rebuild_index();
+}
+
+void ScheduleProfile::rebuild_index() {
+	epochs.clear();
+	for (const MuteFrame& frame : frames) {
+		epochs.push_back({
+			to_epoch(frame.start_year, frame.start_month, frame.start_day, frame.start_hour, frame.start_minute),
+			to_epoch(frame.end_year, frame.end_month, frame.end_day, frame.end_hour, frame.end_minute)
+		});
+	}
+}
+
+void ScheduleProfile::save() {
+	save_mute_frames(frames, false, file_name);
+}
+
+
+UpcomingTransitions::UpcomingTransitions(const ScheduleProfile& profile, std::time_t from)
+	: last_change(from), periodic_from(from) {
+	for (size_t i = 0; i < profile.frames.size(); i++) {
+		bool repeat = profile.frames[i].repeat_every_week;
+		std::time_t start_time = profile.epochs[i].first;
+		std::time_t end_time = profile.epochs[i].second;
+
+		if (repeat) {
+			roll_to_current_week(start_time, end_time, from);
+		}
+
+		if (from >= start_time && from < end_time) {
+			// frame is already active, only its end is upcoming
+			active_frames++;
+			events.push({ end_time, false, repeat });
+			if (repeat) {
+				events.push({ start_time + SECONDS_IN_WEEK, true, repeat });
+			}
+		}
+		else if (start_time > from) {
+			events.push({ start_time, true, repeat });
+			events.push({ end_time, false, repeat });
+		}
+		else if (repeat) {
+			events.push({ start_time + SECONDS_IN_WEEK, true, repeat });
+			events.push({ end_time + SECONDS_IN_WEEK, false, repeat });
+		}
+		else {
+			continue; // outdated frame
+		}
+
+		// a weekly frame first starting later than a week from now must still be reached
+		periodic_from = std::max(periodic_from, repeat ? start_time : end_time);
+	}
+}
+
+bool UpcomingTransitions::next(MuteTransition& transition) {
+	while (!events.empty()) {
+		std::time_t time = events.top().time;
+
+		// only weekly frames are left and a whole week passed without a change, so nothing will ever change
+		if (time > std::max(last_change, periodic_from) + SECONDS_IN_WEEK) {
+			return false;
+		}
+
+		// apply all events from the same moment, e.g. one frame ending when another starts is not a change
+		bool was_muted = active_frames > 0;
+		while (!events.empty() && events.top().time == time) {
+			Event event = events.top();
+			events.pop();
+			active_frames += event.is_start ? 1 : -1;
+
+			if (event.repeat_every_week) {
+				event.time += SECONDS_IN_WEEK;
+				events.push(event);
+			}
+		}
+
+		if ((active_frames > 0) != was_muted) {
+			last_change = time;
+			transition = { time, active_frames > 0 };
+			return true;
+		}
+	}
+
+	return false;
 }
 
 
@@ -575,6 +784,8 @@ TaskBarIcon::TaskBarIcon(MainFrame* parentFrame) : wxTaskBarIcon(), main_frame(p
 	SetIcon(wxIcon(wxT("icon.ico"), wxBITMAP_TYPE_ICO));
 	Bind(wxEVT_TASKBAR_LEFT_DOWN, &TaskBarIcon::left_button_click, this);
 	Bind(wxEVT_TASKBAR_RIGHT_DOWN, &TaskBarIcon::right_button_click, this);
+	Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnMenuEvent, main_frame, MENU_EXIT_OPTION_ID);
+	Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnMenuEvent, main_frame, MENU_PROFILE_OPTION_ID, MENU_PROFILE_OPTION_ID + profile_count - 1);
 }
 
 void TaskBarIcon::left_button_click(wxTaskBarIconEvent&) {
@@ -586,7 +797,13 @@ void TaskBarIcon::left_button_click(wxTaskBarIconEvent&) {
 
 void TaskBarIcon::right_button_click(wxTaskBarIconEvent&) {
 	wxMenu menu;
+	std::vector<std::string> names = main_frame->get_profile_names();
+	std::string active_name = main_frame->get_active_profile_name();
+	for (size_t i = 0; i < names.size(); i++) {
+		menu.AppendRadioItem(MENU_PROFILE_OPTION_ID + i, names[i]);
+		menu.Check(MENU_PROFILE_OPTION_ID + i, names[i] == active_name);
+	}
+	menu.AppendSeparator();
 	menu.Append(MENU_EXIT_OPTION_ID, "Exit");
-	Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnMenuEvent, main_frame, MENU_EXIT_OPTION_ID);
 	PopupMenu(&menu);
 }
\ No newline at end of file
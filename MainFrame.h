@@ -4,18 +4,26 @@
 #include <thread>
 #include <condition_variable>
 #include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ctime>
+#include <queue>
+#include <functional>
 #include <wx/taskbar.h>
 #include <wx/menu.h>
 
 class TaskBarIcon;
 class MuteFrame;
+class ScheduleProfile;
 class MainFrame;
 
 class MuteFrame {
 public:
 	MuteFrame();
 	MuteFrame(int start_year, int start_month, int start_day, int start_hour, int start_minute, int end_year, int end_month, int end_day, int end_hour, int end_minute, bool repeat_every_week);
-	std::string to_string();
+	std::string to_string(std::time_t start_time, std::time_t end_time);
 
 	int id;
 	int start_year;
@@ -31,14 +39,57 @@ public:
 	bool repeat_every_week;
 
 private:
-	bool does_overlap_with_current_time();
+	bool does_overlap_with_current_time(std::time_t start_time, std::time_t end_time);
+};
+
+// Named schedule (e.g. office, home) with its frames kept in memory, so switching profiles doesn't reread any file
+class ScheduleProfile {
+public:
+	ScheduleProfile(const std::string& name);
+	void rebuild_index();
+	void save();
+
+	std::string name;
+	std::string file_name;
+	std::vector<MuteFrame> frames;
+	std::vector<std::pair<std::time_t, std::time_t>> epochs; // <start, end> of every frame, same order as frames
+};
+
+struct MuteTransition {
+	std::time_t time;
+	bool mute; // true when the sound gets muted, false when it gets unmuted
+};
+
+// Yields upcoming mute/unmute changes of a profile in time order.
+// Every frame keeps only its next start and end in a heap, so only the consumed transitions are computed.
+class UpcomingTransitions {
+public:
+	UpcomingTransitions(const ScheduleProfile& profile, std::time_t from);
+	bool next(MuteTransition& transition); // false when there are no more transitions
+
+private:
+	struct Event {
+		std::time_t time;
+		bool is_start;
+		bool repeat_every_week;
+		bool operator>(const Event& other) const { return time > other.time; }
+	};
+
+	std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events;
+	int active_frames = 0;
+	std::time_t last_change;
+	std::time_t periodic_from; // end of the last one-time frame or first start of the last weekly frame, after it the schedule only repeats weekly
 };
 
 class MainFrame : public wxFrame {
 public:
-	MainFrame(const wxString& title);
+	MainFrame(const wxString& title, const std::string& startup_profile = "");
 	void OnMenuEvent(wxCommandEvent& event);
 	void delete_frame(int line_no);
+	void switch_profile(const std::string& name);
+	std::vector<std::string> get_profile_names();
+	std::string get_active_profile_name();
+	std::vector<MuteTransition> get_next_transitions(int count);
 
 private:
 	wxRadioBox* start_day;
@@ -51,6 +102,9 @@ private:
 	wxButton* add_button;
 	wxListBox* frame_list;
 	wxButton* delete_button;
+	wxSpinCtrl* upcoming_count;
+	wxListBox* upcoming_list;
+	std::atomic<int> upcoming_transition_count{ 5 }; // copy of upcoming_count, so the worker thread doesn't read the control
 	wxButton* autostart_button;
 	TaskBarIcon* task_bar_icon;
 
@@ -59,12 +113,19 @@ private:
 	std::thread thread_event;
 	bool terminate_thread = false;
 
+	std::vector<std::unique_ptr<ScheduleProfile>> profiles;
+	std::atomic<ScheduleProfile*> active_profile;
+	std::mutex profile_mtx; // guards frames and epochs of the profiles
+
 	void OnAddButtonClicked(wxCommandEvent& event);
 	void autostart_button_clicked(wxCommandEvent& event);
 	void manage_frames_in_thread();
 	int manage_frames();
 	void OnClose(wxCloseEvent& event);
 	void OnDeleteButtonClicked(wxCommandEvent& event);
+	void OnUpcomingCountChanged(wxSpinEvent& event);
+	void show_upcoming_transitions(const std::vector<MuteTransition>& transitions);
+	ScheduleProfile* find_profile(const std::string& name);
 	~MainFrame();
 };
 